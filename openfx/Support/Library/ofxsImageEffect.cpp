@@ -39,6 +39,7 @@ England
 #include "ofxsSupportPrivate.h"
 #include <algorithm> // for find
 #include <cstring> // for strlen
+#include <cstdio> // for snprintf
 #ifdef DEBUG_BUILD
 #include <iostream>
 #endif
@@ -796,10 +797,11 @@ namespace OFX {
 
   ////////////////////////////////////////////////////////////////////////////////
   // wraps up an image
-  ImageBase::ImageBase(OfxPropertySetHandle props)
+  ImageBase::ImageBase(OfxPropertySetHandle props, bool validate)
     : _imageProps(props)
   {
-    OFX::Validation::validateImageBaseProperties(props);
+    if(validate)
+      OFX::Validation::validateImageBaseProperties(props);
 
     // and fetch all the properties
     _rowBytes         = _imageProps.propGetInt(kOfxImagePropRowBytes);
@@ -886,10 +888,11 @@ namespace OFX {
 
   ////////////////////////////////////////////////////////////////////////////////
   // wraps up an image
-  Image::Image(OfxPropertySetHandle props)
-    : ImageBase(props)
+  Image::Image(OfxPropertySetHandle props, bool validate)
+    : ImageBase(props, validate)
   {
-    OFX::Validation::validateImageProperties(props);
+    if(validate)
+      OFX::Validation::validateImageProperties(props);
 
     // and fetch all the properties
     // should throw if it is not an image
@@ -904,10 +907,11 @@ namespace OFX {
 #ifdef OFX_SUPPORTS_OPENGLRENDER
   ////////////////////////////////////////////////////////////////////////////////
   // wraps up an OpenGL texture
-  Texture::Texture(OfxPropertySetHandle props)
-    : ImageBase(props)
+  Texture::Texture(OfxPropertySetHandle props, bool validate)
+    : ImageBase(props, validate)
   {
-    OFX::Validation::validateTextureProperties(props);
+    if(validate)
+      OFX::Validation::validateTextureProperties(props);
 
     // should throw if it is not a texture
     _index = _imageProps.propGetInt(kOfxImageEffectPropOpenGLTextureIndex);
@@ -952,14 +956,39 @@ namespace OFX {
   ////////////////////////////////////////////////////////////////////////////////
   // clip instance
 
+#ifndef kOfxsDisableValidation
+  namespace Private {
+    /** @brief format of the last image whose properties a clip validated, see Clip::validateImageFormat */
+    class ImageValidationCache {
+    public :
+      std::string format;
+
+      /** @brief guards format, images may be fetched from several render threads */
+      OFX::MultiThread::Mutex mutex;
+    };
+  };
+#endif
+
   /** @brief hidden constructor */
   Clip::Clip(ImageEffect *effect, const std::string &name, OfxImageClipHandle handle, OfxPropertySetHandle props)
     : _clipName(name)
     , _clipProps(props)
     , _clipHandle(handle)
     , _effect(effect)
+    , _imageValidation(NULL)
   {
     OFX::Validation::validateClipInstanceProperties(_clipProps);
+#ifndef kOfxsDisableValidation
+    _imageValidation = new Private::ImageValidationCache;
+#endif
+  }
+
+  /** @brief hidden destructor */
+  Clip::~Clip()
+  {
+#ifndef kOfxsDisableValidation
+    delete _imageValidation;
+#endif
   }
 
   /** @brief fetch the label */
@@ -1199,7 +1228,9 @@ namespace OFX {
     else
       throwSuiteStatusException(stat);
 
-    return new Image(imageHandle);
+    Image *image = new Image(imageHandle, false);
+    validateImageFormat(*image, false);
+    return image;
   }
 
   /** @brief fetch an image, with a specific region in cannonical coordinates */
@@ -1213,7 +1244,45 @@ namespace OFX {
     else
       throwSuiteStatusException(stat);
 
-    return new Image(imageHandle);
+    Image *image = new Image(imageHandle, false);
+    validateImageFormat(*image, false);
+    return image;
+  }
+
+  /** @brief validate a fetched image or texture
+
+  Property validation costs dozens of property suite calls, far too many to pay on every
+  image fetched at render time. Which properties an image carries, and their allowed values,
+  only depend on its pixel format, so they are validated the first time a clip hands out an
+  image in a given format and skipped until the format changes. Bounds, row bytes and render
+  scale are deliberately left out, they change with every tile or RoI.
+  */
+  void Clip::validateImageFormat(const ImageBase &image, bool isTexture)
+  {
+#ifdef kOfxsDisableValidation
+    (void)image;
+    (void)isTexture;
+#else
+    char format[64];
+    snprintf(format, sizeof(format), "%d %d %d %d %d",
+      (int) image.getPixelComponents(), (int) image.getPixelDepth(), (int) image.getPreMultiplication(),
+      (int) image.getField(), (int) isTexture);
+
+    OFX::MultiThread::AutoMutexT<OFX::MultiThread::Mutex> lock(_imageValidation->mutex);
+    if(_imageValidation->format == format)
+      return;
+    _imageValidation->format = format;
+
+    PropertySet props = image.getPropertySet();
+    OFX::Validation::validateImageBaseProperties(props);
+#ifdef OFX_SUPPORTS_OPENGLRENDER
+    if(isTexture) {
+      OFX::Validation::validateTextureProperties(props);
+      return;
+    }
+#endif
+    OFX::Validation::validateImageProperties(props);
+#endif
   }
 
 #ifdef OFX_SUPPORTS_OPENGLRENDER
@@ -1227,7 +1296,9 @@ namespace OFX {
     if (stat != kOfxStatOK) {
       throwSuiteStatusException(stat);
     }
-    return new Texture(hTex);
+    Texture *texture = new Texture(hTex, false);
+    validateImageFormat(*texture, true);
+    return texture;
   }
 #endif
   ////////////////////////////////////////////////////////////////////////////////
@@ -1268,12 +1339,8 @@ namespace OFX {
     _effectProps.propSetPointer(kOfxPropInstanceData, 0);
 
     // delete any clip instances we may have constructed
-    std::map<std::string, Clip *>::iterator iter;
-    for(iter = _fetchedClips.begin(); iter != _fetchedClips.end(); ++iter) {
-      if(iter->second) {
-        delete iter->second;
-        iter->second = NULL;
-      }
+    for(size_t i = 0; i < _fetchedClips.size(); ++i) {
+      delete _fetchedClips.valueAt(i);
     }
   }
 
@@ -1409,10 +1476,8 @@ namespace OFX {
   Clip *ImageEffect::fetchClip(const std::string &name)
   {
     // do we have the clip already
-    std::map<std::string, Clip *>::const_iterator search;
-    search = _fetchedClips.find(name);
-    if(search != _fetchedClips.end())
-      return search->second;
+    if(Clip *clip = _fetchedClips.find(name))
+      return clip;
 
     // fetch the property set handle of the effect
     OfxImageClipHandle clipHandle = 0;
@@ -1424,7 +1489,7 @@ namespace OFX {
     Clip *newClip = new Clip(this, name, clipHandle, propHandle);
 
     // add it in
-    _fetchedClips[name] = newClip;
+    _fetchedClips.insert(name, newClip);
 
     // return it
     return newClip;
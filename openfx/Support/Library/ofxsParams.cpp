@@ -2914,12 +2914,8 @@ namespace OFX {
   ParamSet::~ParamSet()
   {
     // delete any descriptor we may have constructed
-    std::map<std::string, Param *>::iterator iter;
-    for(iter = _fetchedParams.begin(); iter != _fetchedParams.end(); ++iter) {
-      if(iter->second) {
-        delete iter->second;
-        iter->second = NULL;
-      }
+    for(size_t i = 0; i < _fetchedParams.size(); ++i) {
+      delete _fetchedParams.valueAt(i);
     }
   }
 
@@ -3089,11 +3085,7 @@ namespace OFX {
     ParamSet::findPreviouslyFetchedParam(const std::string &name) const
   {
     // search
-    std::map<std::string, Param *>::const_iterator search;
-    search = _fetchedParams.find(name);
-    if(search == _fetchedParams.end())
-      return NULL;
-    return search->second;
+    return _fetchedParams.find(name);
   }
 
   /** @brief Fetch an integer param, only callable from describe in context */
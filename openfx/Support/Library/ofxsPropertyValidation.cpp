@@ -49,14 +49,8 @@ This file contains headers for classes that are used to validate property sets a
 /** @brief Null pointer definition */
 #define NULLPTR ((void *)(0))
 
-// #define  kOfxsDisableValidation
+// validation is disabled in ofxsSupportPrivate.h unless DEBUG_BUILD is defined
 
-// disable validation if not a debug build
-#ifndef DEBUG_BUILD
-#define  kOfxsDisableValidation
-#endif
-
-//#define kOfxsDisableValidation
 /** @brief OFX namespace
 */
 namespace OFX {
@@ -89,6 +89,10 @@ namespace OFX {
   class ImageEffect;
   class ImageMemory;
 
+  namespace Private {
+    class ImageValidationCache;
+  };
+
   /** @brief Enumerates the contexts a plugin can be used in */
   enum ContextEnum {eContextNone,
     eContextGenerator,
@@ -534,8 +538,12 @@ namespace OFX {
     OfxPointD _renderScale;                  /**< @brief any scaling factor applied to the image */
 
   public :
-    /** @brief ctor */
-    ImageBase(OfxPropertySetHandle props);
+    /** @brief ctor
+
+    \arg \e validate - validate the image properties against the image property schema. Images
+    fetched from a clip skip this, the clip validates them once per image format instead.
+    */
+    ImageBase(OfxPropertySetHandle props, bool validate = true);
 
     /** @brief dtor */
     virtual ~ImageBase();
@@ -588,8 +596,8 @@ namespace OFX {
     void     *_pixelData;                    /**< @brief the base address of the image */
 
   public :
-    /** @brief ctor */
-    Image(OfxPropertySetHandle props);
+    /** @brief ctor, see ImageBase::ImageBase for \e validate */
+    Image(OfxPropertySetHandle props, bool validate = true);
 
     /** @brief dtor */
     virtual ~Image();
@@ -627,8 +635,8 @@ namespace OFX {
     int _target;
 
   public :
-    /** @brief ctor */
-    Texture(OfxPropertySetHandle props);
+    /** @brief ctor, see ImageBase::ImageBase for \e validate */
+    Texture(OfxPropertySetHandle props, bool validate = true);
 
     /** @brief dtor */
     virtual ~Texture();
@@ -658,9 +666,18 @@ namespace OFX {
     /** @brief effect instance that owns this clip */
     ImageEffect *_effect;
 
+    /** @brief last image format validated on this clip, NULL when validation is compiled out */
+    Private::ImageValidationCache *_imageValidation;
+
+    /** @brief validate a fetched image's properties, only when its format differs from the last one validated */
+    void validateImageFormat(const ImageBase &image, bool isTexture);
+
     /** @brief hidden constructor */
     Clip(ImageEffect *effect, const std::string &name, OfxImageClipHandle handle, OfxPropertySetHandle props);
 
+    /** @brief hidden destructor */
+    ~Clip();
+
     /** @brief so one can be made */
     friend class ImageEffect;
 
@@ -1021,7 +1038,7 @@ namespace OFX {
     ContextEnum _context;
 
     /** @brief Set of all previously defined parameters, defined on demand */
-    std::map<std::string, Clip *> _fetchedClips;
+    OFX::Private::NameCache<Clip> _fetchedClips;
 
     /** @brief the overlay interacts that are open on this image effect */
     std::list<OverlayInteract *> _overlayInteracts;
@@ -0,0 +1,134 @@
+#ifndef _ofxsNameCache_H_
+#define _ofxsNameCache_H_
+// Copyright OpenFX and contributors to the OpenFX project.
+// SPDX-License-Identifier: BSD-3-Clause
+
+/** @file This file contains a small flat hash cache used to look up fetched params and clips by name.
+
+Params and clips are fetched by name on every render by many plugins, so the lookup
+from name to the support library object needs to be cheap. Benchmarks/NameCacheBenchmark.cpp
+times it against the std::map it replaced and against a cached handle.
+
+Note that the NDI Output plugin in this repository uses the OFX C API directly, and neither its
+Makefile nor its CMakeLists.txt compiles openfx/Support/Library, so this only affects plugins
+built on the C++ support library.
+*/
+
+#include <string>
+#include <vector>
+#include <string.h>
+
+namespace OFX {
+
+  namespace Private {
+
+    /** @brief FNV-1a hash of a name */
+    inline size_t hashName(const char *name, size_t length)
+    {
+      size_t hash = (size_t) 2166136261u;
+      for(size_t i = 0; i < length; ++i) {
+        hash ^= (unsigned char) name[i];
+        hash *= (size_t) 16777619u;
+      }
+      return hash;
+    }
+
+    /** @brief Flat, open addressing map from names to objects.
+
+    Each name is copied into the cache and hashed once when inserted. A lookup hashes the
+    key, probes a contiguous slot array and only compares strings when the hashes match.
+
+    Entries are never removed, so the pointer returned by find for a name stays the same
+    for the lifetime of the cache and callers may keep it as a handle. The cache does not
+    own the objects it points to.
+    */
+    template <class T>
+    class NameCache {
+    private :
+      /** @brief an interned name and the object it maps to */
+      struct Entry {
+        std::string name;
+        size_t hash;
+        T *value;
+      };
+
+      /** @brief entries in insertion order */
+      std::vector<Entry> _entries;
+
+      /** @brief open addressing table of indices into _entries plus one, 0 marks an empty slot */
+      std::vector<size_t> _slots;
+
+      /** @brief find the slot holding the given name, or the empty slot it would go in */
+      size_t findSlot(const char *name, size_t length, size_t hash) const
+      {
+        size_t mask = _slots.size() - 1;
+        size_t slot = hash & mask;
+        while(_slots[slot]) {
+          const Entry &entry = _entries[_slots[slot] - 1];
+          if(entry.hash == hash && entry.name.size() == length && memcmp(entry.name.data(), name, length) == 0)
+            break;
+          slot = (slot + 1) & mask;
+        }
+        return slot;
+      }
+
+      /** @brief double the slot table and re-insert every entry */
+      void grow()
+      {
+        size_t newSize = _slots.empty() ? 16 : _slots.size() * 2;
+        _slots.assign(newSize, 0);
+        for(size_t i = 0; i < _entries.size(); ++i) {
+          const Entry &entry = _entries[i];
+          _slots[findSlot(entry.name.data(), entry.name.size(), entry.hash)] = i + 1;
+        }
+      }
+
+      T *find(const char *name, size_t length) const
+      {
+        if(_slots.empty())
+          return NULL;
+        size_t slot = findSlot(name, length, hashName(name, length));
+        return _slots[slot] ? _entries[_slots[slot] - 1].value : NULL;
+      }
+
+    public :
+      /** @brief look up a name, returns NULL if it has not been inserted */
+      T *find(const std::string &name) const { return find(name.data(), name.size()); }
+
+      /** @brief look up a name, returns NULL if it has not been inserted */
+      T *find(const char *name) const { return find(name, strlen(name)); }
+
+      /** @brief add or replace the object for a name */
+      void insert(const std::string &name, T *value)
+      {
+        // keep the load factor at or below one half
+        if((_entries.size() + 1) * 2 > _slots.size())
+          grow();
+
+        size_t hash = hashName(name.data(), name.size());
+        size_t slot = findSlot(name.data(), name.size(), hash);
+        if(_slots[slot]) {
+          _entries[_slots[slot] - 1].value = value;
+          return;
+        }
+
+        Entry entry;
+        entry.name = name;
+        entry.hash = hash;
+        entry.value = value;
+        _entries.push_back(entry);
+        _slots[slot] = _entries.size();
+      }
+
+      /** @brief number of names in the cache */
+      size_t size() const { return _entries.size(); }
+
+      /** @brief the object for the nth inserted name, used to walk every entry */
+      T *valueAt(size_t n) const { return _entries[n].value; }
+    };
+
+  };
+
+};
+
+#endif
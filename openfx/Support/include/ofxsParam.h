@@ -50,6 +50,7 @@ each represent the actions that can be carried out on those particular OFX objec
 
 #include <memory>
 #include "ofxsCore.h"
+#include "ofxsNameCache.h"
 
 /** @brief Nasty macro used to define empty protected copy ctors and assign ops */
 #define mDeclareProtectedAssignAndCC(CLASS) \
@@ -1782,7 +1783,7 @@ namespace OFX {
         OfxParamSetHandle _paramSetHandle;
 
         /** @brief Set of all previously fetched parameters, created on demand */
-        mutable std::map<std::string, Param *> _fetchedParams;
+        mutable OFX::Private::NameCache<Param> _fetchedParams;
 
         /** @brief see if we have a param of the given name in out map */
         Param *findPreviouslyFetchedParam(const std::string &name) const;
@@ -1813,7 +1814,7 @@ namespace OFX {
                 paramPtr = new T(this, name, paramHandle);
 
                 // add it to our map of described ones
-                _fetchedParams[name] = paramPtr;
+                _fetchedParams.insert(name, paramPtr);
             }
         }
 
@@ -43,6 +43,13 @@ England
 #include "ofxsLog.h"
 #include "ofxsMultiThread.h"
 
+// #define  kOfxsDisableValidation
+
+// disable validation if not a debug build
+#ifndef DEBUG_BUILD
+#define  kOfxsDisableValidation
+#endif
+
 /** @brief Namespace private to the ofx support library.
 */
 namespace OFX {
@@ -23,6 +23,8 @@
 #include <condition_variable>
 #include <queue>
 #include <chrono>
+#include <algorithm>
+#include <cstdlib>
 
 #ifdef __APPLE__
 #include <os/log.h>
@@ -34,6 +36,7 @@
 #include "ofxImageEffect.h"
 #include "ofxMemory.h"
 #include "ofxMultiThread.h"
+#include "ofxProgress.h"
 
 #ifdef __APPLE__
 #include "MetalGPUAcceleration.h"
@@ -116,6 +119,27 @@
 #define kParamOptimalFormatLabel "Optimal Color Format"
 #define kParamOptimalFormatHint "Use UYVY color format for optimal NDI performance"
 
+#define kParamLetterboxSkip "letterboxSkip"
+#define kParamLetterboxSkipLabel "Skip Letterbox Bars"
+#define kParamLetterboxSkipHint "Detect constant-colour letterbox/pillarbox bars and fill them directly instead of converting every pixel"
+
+// Benchmark Parameters
+#define kParamRunBenchmark "runBenchmark"
+#define kParamRunBenchmarkLabel "Run Benchmark"
+#define kParamRunBenchmarkHint "Convert and send synthetic frames at the current resolution and format with every available backend, then report the sustained throughput. Test frames go to a temporary \"(Benchmark)\" NDI source, never to the live output."
+
+#define kParamBenchmarkReport "benchmarkReport"
+#define kParamBenchmarkReportLabel "Benchmark Report"
+#define kParamBenchmarkReportHint "Results of the last benchmark run (also written to " kBenchmarkReportFile " in the temp directory)"
+
+// Benchmark settings
+#define kBenchmarkSecondsPerBackend 2.0
+#define kBenchmarkMaxFrames 600
+#define kBenchmarkDefaultWidth 1920
+#define kBenchmarkDefaultHeight 1080
+#define kBenchmarkReportFile "NDIOutput_benchmark.txt"
+#define kBenchmarkSourceSuffix " (Benchmark)"
+
 // Version Display Parameter
 #define kParamVersionLabel "versionLabel"
 #define kParamVersionLabelLabel "Plugin Version"
@@ -142,6 +166,41 @@
 #define kParamMaxFALLLabel "Max Frame Average Light Level"
 #define kParamMaxFALLHint "Maximum frame average light level in nits"
 
+// Remote Scopes Parameters
+#define kParamScopesEnabled "scopesEnabled"
+#define kParamScopesEnabledLabel "Send Remote Scopes"
+#define kParamScopesEnabledHint "Publish waveform, RGB parade and histogram data as NDI metadata alongside the video"
+
+#define kParamScopesInterval "scopesInterval"
+#define kParamScopesIntervalLabel "Scopes Interval (frames)"
+#define kParamScopesIntervalHint "Publish scope data once every N frames"
+
+// Remote scope layout
+#define kScopeColumns 64        // Waveform columns across the frame width
+#define kScopeLevels 32         // Waveform levels per column
+#define kScopeHistogramBins 64  // Histogram bins per channel
+#define kScopeBands 8           // Horizontal bands, each with its own partial buffers
+#define kScopeChannels 4        // Y, R, G, B
+
+// Letterbox detection
+#define kLetterboxMinBar 8                      // Bars thinner than this are converted normally
+#define kLetterboxTolerance (1.0f / 1024.0f)    // Max per-channel deviation from the bar colour
+#define kLetterboxMaxCoverage 2                 // Bars together cover at most 1/N of the height or width
+#define kLetterboxVerifyFrames 8                // Every bar row is re-checked at least once in this many frames
+#define kLetterboxRedetectFrames 120            // Re-run full detection to pick up larger bars
+
+// Memory pressure sampling (Linux PSI and cgroup limits)
+#define kMemoryPSISomeThreshold 10.0    // PSI "some avg10" percentage treated as moderate pressure
+#define kMemoryPSIFullThreshold 5.0     // PSI "full avg10" percentage treated as critical pressure
+#define kMemoryCgroupModerateRatio 0.85 // cgroup usage / limit treated as moderate pressure
+#define kMemoryCgroupCriticalRatio 0.95 // cgroup usage / limit treated as critical pressure
+
+enum MemoryPressureLevel {
+    kMemoryPressureNone = 0,
+    kMemoryPressureModerate,
+    kMemoryPressureCritical
+};
+
 // Color Space Options
 #define kColorSpaceRec709 "rec709"
 #define kColorSpaceRec2020 "rec2020"
@@ -160,6 +219,7 @@ OfxParameterSuiteV1     *gParamHost = 0;
 OfxMemorySuiteV1        *gMemoryHost = 0;
 OfxMultiThreadSuiteV1   *gThreadHost = 0;
 OfxMessageSuiteV1       *gMessageSuite = 0;
+OfxProgressSuiteV1      *gProgressHost = 0;
 
 // GPU Processing Context
 struct GPUContext {
@@ -181,6 +241,27 @@ struct GPUContext {
     std::mutex gpuMutex;
 };
 
+// Partial scope accumulators for one horizontal band of the frame.
+// Bands are merged once per published frame.
+struct ScopeBand {
+    uint32_t waveform[kScopeChannels][kScopeColumns][kScopeLevels]; // Luma waveform + RGB parade
+    uint32_t histogram[kScopeChannels][kScopeHistogramBins];
+};
+
+// Constant-colour bars detected for the current shot, in NDI (top-left origin) coordinates.
+// left is even and width - right is even or width, so bars never split a 4:2:2 pair.
+struct LetterboxState {
+    bool active;
+    int width;
+    int height;
+    int top;
+    int bottom;
+    int left;
+    int right;
+    float color[3];
+    int framesSinceDetect;
+};
+
 // Asynchronous frame processing
 struct AsyncFrameData {
     std::vector<uint8_t> frameData;
@@ -203,12 +284,17 @@ struct NDIInstanceData {
     OfxParamHandle gpuAccelerationParam;
     OfxParamHandle asyncSendingParam;
     OfxParamHandle optimalFormatParam;
+    OfxParamHandle letterboxSkipParam;
     OfxParamHandle versionLabelParam;
     OfxParamHandle hdrEnabledParam;
     OfxParamHandle colorSpaceParam;
     OfxParamHandle transferFunctionParam;
     OfxParamHandle maxCLLParam;
     OfxParamHandle maxFALLParam;
+    OfxParamHandle scopesEnabledParam;
+    OfxParamHandle scopesIntervalParam;
+    OfxParamHandle runBenchmarkParam;
+    OfxParamHandle benchmarkReportParam;
     
     // NDI variables
     NDIlib_send_instance_t ndiSend;
@@ -216,11 +302,16 @@ struct NDIInstanceData {
     std::string sourceName;
     bool enabled;
     double frameRate;
+    int lastWidth;            // Size of the last rendered frame, used by the benchmark
+    int lastHeight;
+    const char* lastBackend;  // Backend that performed the last conversion
     
     // GPU acceleration settings
     bool gpuAcceleration;
     bool asyncSending;
     bool optimalFormat;
+    bool letterboxSkip;
+    LetterboxState letterbox;
     std::unique_ptr<GPUContext> gpuContext;
     
     // HDR parameters
@@ -236,6 +327,15 @@ struct NDIInstanceData {
     std::vector<uint8_t> uyvyFrameBuffer; // UYVY format for optimal performance
     std::string hdrMetadataXML;
     
+    // Remote scopes
+    bool scopesEnabled;
+    int scopesInterval;
+    int scopesFrameCounter;
+    bool scopesActive;       // Accumulate scopes for the frame being converted
+    bool scopesAccumulated;  // Set by conversion loops that filled the bands
+    std::vector<ScopeBand> scopeBands;
+    std::string scopesMetadataXML;
+    
     // Asynchronous processing
     std::thread asyncThread;
     std::queue<AsyncFrameData> frameQueue;
@@ -254,6 +354,363 @@ static void convertRGBAToUYVY_CPU(NDIInstanceData* data, void* rgbaData, int wid
 static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int height);
 static void sendSDRFrame(NDIInstanceData* data, void* imageData, int width, int height);
 
+// Remote scope helpers
+static inline int scopeBin(float value, int bins)
+{
+    int bin = static_cast<int>(value * bins);
+    return bin < 0 ? 0 : (bin >= bins ? bins - 1 : bin);
+}
+
+static inline void accumulateScopeSample(ScopeBand& band, int column, float luma, float r, float g, float b)
+{
+    const float values[kScopeChannels] = { luma, r, g, b };
+    for (int c = 0; c < kScopeChannels; ++c) {
+        band.waveform[c][column][scopeBin(values[c], kScopeLevels)]++;
+        band.histogram[c][scopeBin(values[c], kScopeHistogramBins)]++;
+    }
+}
+
+static void beginScopesFrame(NDIInstanceData* data)
+{
+    data->scopesActive = false;
+    data->scopesAccumulated = false;
+    if (!data->scopesEnabled) {
+        return;
+    }
+
+    int interval = std::max(1, data->scopesInterval);
+    if ((data->scopesFrameCounter++ % interval) != 0) {
+        return;
+    }
+
+    data->scopeBands.resize(kScopeBands);
+    memset(data->scopeBands.data(), 0, sizeof(ScopeBand) * data->scopeBands.size());
+    data->scopesActive = true;
+}
+
+static void accumulateScopesFromRGBA(NDIInstanceData* data, const float* srcData, int width, int height,
+                                     float kr, float kg, float kb)
+{
+    // GPU conversions don't produce scope data, so sample every other row and column of the source
+    for (int y = 0; y < height; y += 2) {
+        int srcRow = height - 1 - y; // Flip vertically to match the NDI frame
+        ScopeBand& band = data->scopeBands[y * kScopeBands / height];
+        for (int x = 0; x < width; x += 2) {
+            const float* px = srcData + (static_cast<size_t>(srcRow) * width + x) * 4;
+            float r = std::max(0.0f, std::min(1.0f, px[0]));
+            float g = std::max(0.0f, std::min(1.0f, px[1]));
+            float b = std::max(0.0f, std::min(1.0f, px[2]));
+            accumulateScopeSample(band, x * kScopeColumns / width, kr * r + kg * g + kb * b, r, g, b);
+        }
+    }
+    data->scopesAccumulated = true;
+}
+
+static void appendScopeHex(std::string& out, const uint32_t* counts, int count)
+{
+    // Normalise to 8 bits relative to the largest bin and hex encode
+    static const char kHex[] = "0123456789abcdef";
+    uint32_t maxCount = 1;
+    for (int i = 0; i < count; ++i) {
+        maxCount = std::max(maxCount, counts[i]);
+    }
+    for (int i = 0; i < count; ++i) {
+        uint32_t value = static_cast<uint32_t>((static_cast<uint64_t>(counts[i]) * 255 + maxCount - 1) / maxCount);
+        out += kHex[value >> 4];
+        out += kHex[value & 0xF];
+    }
+}
+
+static void finishScopesFrame(NDIInstanceData* data, const float* srcData, int width, int height,
+                              float kr, float kg, float kb)
+{
+    if (!data->scopesActive) {
+        return;
+    }
+    data->scopesActive = false;
+
+    // GPU conversions (the default on macOS and Windows) don't accumulate scopes, so those
+    // frames fall back to a 2x2 subsampled pass and are flagged as sampled in the metadata
+    bool sampled = !data->scopesAccumulated;
+    if (sampled) {
+        accumulateScopesFromRGBA(data, srcData, width, height, kr, kg, kb);
+    }
+
+    // Merge band partials into the first band
+    ScopeBand& merged = data->scopeBands[0];
+    for (int i = 1; i < kScopeBands; ++i) {
+        const ScopeBand& band = data->scopeBands[i];
+        for (int c = 0; c < kScopeChannels; ++c) {
+            for (int col = 0; col < kScopeColumns; ++col) {
+                for (int l = 0; l < kScopeLevels; ++l) {
+                    merged.waveform[c][col][l] += band.waveform[c][col][l];
+                }
+            }
+            for (int bin = 0; bin < kScopeHistogramBins; ++bin) {
+                merged.histogram[c][bin] += band.histogram[c][bin];
+            }
+        }
+    }
+
+    // Compact per-frame metadata: one hex byte per waveform cell / histogram bin
+    static const char* kChannelNames[kScopeChannels] = { "Y", "R", "G", "B" };
+    char header[192];
+    snprintf(header, sizeof(header),
+             "<ndi_scopes width=\"%d\" height=\"%d\" columns=\"%d\" levels=\"%d\" bins=\"%d\" sampled=\"%d\">",
+             width, height, kScopeColumns, kScopeLevels, kScopeHistogramBins, sampled ? 1 : 0);
+
+    std::string& xml = data->scopesMetadataXML;
+    xml.clear();
+    xml += header;
+    for (int c = 0; c < kScopeChannels; ++c) {
+        xml += "<waveform ch=\"";
+        xml += kChannelNames[c];
+        xml += "\">";
+        appendScopeHex(xml, &merged.waveform[c][0][0], kScopeColumns * kScopeLevels);
+        xml += "</waveform>";
+    }
+    for (int c = 0; c < kScopeChannels; ++c) {
+        xml += "<histogram ch=\"";
+        xml += kChannelNames[c];
+        xml += "\">";
+        appendScopeHex(xml, merged.histogram[c], kScopeHistogramBins);
+        xml += "</histogram>";
+    }
+    xml += "</ndi_scopes>";
+
+    // Send on the metadata side stream so receivers that ignore it pay nothing
+    NDIlib_metadata_frame_t metadataFrame;
+    metadataFrame.length = static_cast<int>(xml.size());
+    metadataFrame.timecode = NDIlib_send_timecode_synthesize;
+    metadataFrame.p_data = const_cast<char*>(xml.c_str());
+    NDIlib_send_send_metadata(data->ndiSend, &metadataFrame);
+}
+
+static void accumulateScopeRect(NDIInstanceData* data, int width, int height, int y0, int y1, int x0, int x1,
+                                float luma, float r, float g, float b)
+{
+    // Add a constant-colour rectangle to the scopes without visiting its pixels
+    if (y1 <= y0 || x1 <= x0) {
+        return;
+    }
+
+    const float values[kScopeChannels] = { luma, r, g, b };
+    for (int i = 0; i < kScopeBands; ++i) {
+        // Rows y with y * kScopeBands / height == i
+        int bandStart = (i * height + kScopeBands - 1) / kScopeBands;
+        int bandEnd = ((i + 1) * height + kScopeBands - 1) / kScopeBands;
+        int rows = std::min(y1, bandEnd) - std::max(y0, bandStart);
+        if (rows <= 0) {
+            continue;
+        }
+
+        ScopeBand& band = data->scopeBands[i];
+        for (int c = 0; c < kScopeChannels; ++c) {
+            int level = scopeBin(values[c], kScopeLevels);
+            for (int x = x0; x < x1; ++x) {
+                band.waveform[c][x * kScopeColumns / width][level] += rows;
+            }
+            band.histogram[c][scopeBin(values[c], kScopeHistogramBins)] += rows * (x1 - x0);
+        }
+    }
+}
+
+// Letterbox helpers
+static inline bool letterboxRowMatches(const float* srcData, int width, int height, int y, int x0, int x1,
+                                       const float* color)
+{
+    // y is an NDI row; the source is bottom-up
+    const float* px = srcData + (static_cast<size_t>(height - 1 - y) * width + x0) * 4;
+    for (int x = x0; x < x1; ++x, px += 4) {
+        if (std::fabs(px[0] - color[0]) > kLetterboxTolerance ||
+            std::fabs(px[1] - color[1]) > kLetterboxTolerance ||
+            std::fabs(px[2] - color[2]) > kLetterboxTolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Number of pixels, up to limit, matching the bar colour from one edge of a row inwards
+static inline int letterboxRunLength(const float* srcData, int width, int height, int y, bool fromRight, int limit,
+                                     const float* color)
+{
+    const float* row = srcData + static_cast<size_t>(height - 1 - y) * width * 4;
+    int n = 0;
+    while (n < limit) {
+        const float* px = row + static_cast<size_t>(fromRight ? width - 1 - n : n) * 4;
+        if (std::fabs(px[0] - color[0]) > kLetterboxTolerance ||
+            std::fabs(px[1] - color[1]) > kLetterboxTolerance ||
+            std::fabs(px[2] - color[2]) > kLetterboxTolerance) {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+static void detectLetterbox(LetterboxState& lb, const float* srcData, int width, int height)
+{
+    lb.active = false;
+    lb.width = width;
+    lb.height = height;
+    lb.top = lb.bottom = lb.left = lb.right = 0;
+    lb.framesSinceDetect = 0;
+
+    // Bars take the colour of the top-left pixel
+    const float* corner = srcData + static_cast<size_t>(height - 1) * width * 4;
+    lb.color[0] = corner[0];
+    lb.color[1] = corner[1];
+    lb.color[2] = corner[2];
+
+    // Bars covering more than the coverage limit are picture (a black frame between shots, a
+    // title on black), not letterbox, so stop scanning one past the limit and drop them
+    const int maxVertical = height / kLetterboxMaxCoverage;
+    while (lb.top <= maxVertical && letterboxRowMatches(srcData, width, height, lb.top, 0, width, lb.color)) {
+        lb.top++;
+    }
+    while (lb.top + lb.bottom <= maxVertical &&
+           letterboxRowMatches(srcData, width, height, height - 1 - lb.bottom, 0, width, lb.color)) {
+        lb.bottom++;
+    }
+    if (lb.top + lb.bottom > maxVertical) {
+        lb.top = lb.bottom = 0;
+    }
+
+    const int maxHorizontal = width / kLetterboxMaxCoverage;
+    int y0 = lb.top;
+    int y1 = height - lb.bottom;
+    // Side bars are the shortest run of bar colour over every active row, so nothing inside
+    // them is missed; each row stops at the first mismatch or the narrowest bar so far
+    lb.left = maxHorizontal + 1;
+    for (int y = y0; y < y1 && lb.left > 0; ++y) {
+        lb.left = letterboxRunLength(srcData, width, height, y, false, lb.left, lb.color);
+    }
+    lb.right = maxHorizontal + 1 - lb.left;
+    for (int y = y0; y < y1 && lb.right > 0; ++y) {
+        lb.right = letterboxRunLength(srcData, width, height, y, true, lb.right, lb.color);
+    }
+    if (lb.left + lb.right > maxHorizontal) {
+        lb.left = lb.right = 0;
+    }
+
+    if (lb.top < kLetterboxMinBar) lb.top = 0;
+    if (lb.bottom < kLetterboxMinBar) lb.bottom = 0;
+    if (lb.left < kLetterboxMinBar) lb.left = 0;
+    if (lb.right < kLetterboxMinBar) lb.right = 0;
+
+    // Keep 4:2:2 pairs whole by shrinking the side bars
+    lb.left &= ~1;
+    int activeEnd = std::min(width, ((width - lb.right) + 1) & ~1);
+    lb.right = width - activeEnd;
+
+    lb.active = lb.top > 0 || lb.bottom > 0 || lb.left > 0 || lb.right > 0;
+}
+
+static bool verifyLetterboxRegion(const LetterboxState& lb, const float* srcData, int y0, int y1, int x0, int x1)
+{
+    if (y1 <= y0 || x1 <= x0) {
+        return true;
+    }
+
+    // Always check the edges, then every kLetterboxVerifyFrames-th row from a rotating offset.
+    // kLetterboxRedetectFrames is a multiple of the step, so every row is seen within
+    // kLetterboxVerifyFrames frames however tall the bar is
+    if (!letterboxRowMatches(srcData, lb.width, lb.height, y0, x0, x1, lb.color) ||
+        !letterboxRowMatches(srcData, lb.width, lb.height, y1 - 1, x0, x1, lb.color)) {
+        return false;
+    }
+    const int step = kLetterboxVerifyFrames;
+    for (int y = y0 + lb.framesSinceDetect % step; y < y1; y += step) {
+        if (!letterboxRowMatches(srcData, lb.width, lb.height, y, x0, x1, lb.color)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool updateLetterbox(NDIInstanceData* data, const float* srcData, int width, int height)
+{
+    LetterboxState& lb = data->letterbox;
+    if (!data->letterboxSkip) {
+        lb.active = false;
+        return false;
+    }
+
+    bool wasActive = lb.active;
+    bool redetect = !lb.active || lb.width != width || lb.height != height ||
+                    ++lb.framesSinceDetect >= kLetterboxRedetectFrames;
+
+    if (!redetect) {
+        int y1 = height - lb.bottom;
+        bool stillConstant =
+            verifyLetterboxRegion(lb, srcData, 0, lb.top, 0, width) &&
+            verifyLetterboxRegion(lb, srcData, y1, height, 0, width) &&
+            verifyLetterboxRegion(lb, srcData, lb.top, y1, 0, lb.left) &&
+            verifyLetterboxRegion(lb, srcData, lb.top, y1, width - lb.right, width);
+        if (!stillConstant) {
+            NDI_LOG("Letterbox bars no longer constant, re-detecting");
+            redetect = true;
+        }
+    }
+
+    if (redetect) {
+        LetterboxState previous = lb;
+        detectLetterbox(lb, srcData, width, height);
+        if (lb.active && (!wasActive || lb.top != previous.top || lb.bottom != previous.bottom ||
+                          lb.left != previous.left || lb.right != previous.right)) {
+            NDI_LOG("Letterbox detected: top=%d bottom=%d left=%d right=%d", lb.top, lb.bottom, lb.left, lb.right);
+        } else if (!lb.active && wasActive) {
+            NDI_LOG("Letterbox bars gone, converting full frame");
+        }
+    }
+    return lb.active;
+}
+
+static void fillPatternRect(uint8_t* plane, size_t rowBytes, int y0, int y1, int x0, int x1,
+                            const uint8_t* pattern, size_t patternBytes)
+{
+    // All output planes are 2 bytes per pixel
+    if (y1 <= y0 || x1 <= x0) {
+        return;
+    }
+
+    uint8_t* first = plane + y0 * rowBytes + static_cast<size_t>(x0) * 2;
+    const size_t spanBytes = static_cast<size_t>(x1 - x0) * 2;
+
+    // Seed the first row with the pattern and double it up, then copy that row down
+    size_t filled = std::min(patternBytes, spanBytes);
+    memcpy(first, pattern, filled);
+    while (filled < spanBytes) {
+        size_t n = std::min(filled, spanBytes - filled);
+        memcpy(first + filled, first, n);
+        filled += n;
+    }
+    for (int y = y0 + 1; y < y1; ++y) {
+        memcpy(first + (y - y0) * rowBytes, first, spanBytes);
+    }
+}
+
+static void fillLetterboxBars(const LetterboxState& lb, uint8_t* plane, const uint8_t* pattern, size_t patternBytes)
+{
+    const size_t rowBytes = static_cast<size_t>(lb.width) * 2;
+    const int y1 = lb.height - lb.bottom;
+    fillPatternRect(plane, rowBytes, 0, lb.top, 0, lb.width, pattern, patternBytes);
+    fillPatternRect(plane, rowBytes, y1, lb.height, 0, lb.width, pattern, patternBytes);
+    fillPatternRect(plane, rowBytes, lb.top, y1, 0, lb.left, pattern, patternBytes);
+    fillPatternRect(plane, rowBytes, lb.top, y1, lb.width - lb.right, lb.width, pattern, patternBytes);
+}
+
+static void accumulateLetterboxScopes(NDIInstanceData* data, float luma, float r, float g, float b)
+{
+    const LetterboxState& lb = data->letterbox;
+    const int y1 = lb.height - lb.bottom;
+    accumulateScopeRect(data, lb.width, lb.height, 0, lb.top, 0, lb.width, luma, r, g, b);
+    accumulateScopeRect(data, lb.width, lb.height, y1, lb.height, 0, lb.width, luma, r, g, b);
+    accumulateScopeRect(data, lb.width, lb.height, lb.top, y1, 0, lb.left, luma, r, g, b);
+    accumulateScopeRect(data, lb.width, lb.height, lb.top, y1, lb.width - lb.right, lb.width, luma, r, g, b);
+}
+
 // GPU Acceleration Functions
 static bool initializeGPUContext(NDIInstanceData* data)
 {
@@ -391,6 +848,7 @@ static void convertRGBAToUYVY_GPU(NDIInstanceData* data, void* rgbaData, int wid
         );
         
         if (success) {
+            data->lastBackend = "Metal";
             NDI_LOG("✅ Metal GPU acceleration SUCCESS!\n");
             return;
         } else {
@@ -417,6 +875,7 @@ static void convertRGBAToUYVY_GPU(NDIInstanceData* data, void* rgbaData, int wid
         );
         
         if (success) {
+            data->lastBackend = "CUDA";
             NDI_LOG("✅ CUDA GPU acceleration SUCCESS!");
             return;
         } else {
@@ -451,6 +910,7 @@ static void convertRGBAToUYVY_CPU(NDIInstanceData* data, void* rgbaData, int wid
     auto startTime = std::chrono::high_resolution_clock::now();
     
     NDI_LOG("Starting CPU RGBA->UYVY conversion (%dx%d)\n", width, height);
+    data->lastBackend = "CPU";
     
     const size_t uyvySize = width * height * 2; // UYVY is 2 bytes per pixel
     if (data->uyvyFrameBuffer.size() != uyvySize) {
@@ -460,10 +920,38 @@ static void convertRGBAToUYVY_CPU(NDIInstanceData* data, void* rgbaData, int wid
     float* srcData = static_cast<float*>(rgbaData);
     uint8_t* dstData = data->uyvyFrameBuffer.data();
 
+    // Fill constant letterbox bars directly and only convert the active picture
+    int activeTop = 0, activeBottom = height, activeLeft = 0, activeRight = width;
+    if (updateLetterbox(data, srcData, width, height)) {
+        const LetterboxState& lb = data->letterbox;
+        float r = std::max(0.0f, std::min(1.0f, lb.color[0]));
+        float g = std::max(0.0f, std::min(1.0f, lb.color[1]));
+        float b = std::max(0.0f, std::min(1.0f, lb.color[2]));
+        float luma = 0.2126f * r + 0.7152f * g + 0.0722f * b;
+        float u = -0.1146f * r - 0.3854f * g + 0.5f * b;
+        float v = 0.5f * r - 0.4542f * g - 0.0458f * b;
+        const uint8_t pattern[4] = {
+            static_cast<uint8_t>((u + 0.5f) * 255.0f),
+            static_cast<uint8_t>(luma * 255.0f),
+            static_cast<uint8_t>((v + 0.5f) * 255.0f),
+            static_cast<uint8_t>(luma * 255.0f)
+        };
+        fillLetterboxBars(lb, dstData, pattern, sizeof(pattern));
+        if (data->scopesActive) {
+            accumulateLetterboxScopes(data, luma, r, g, b);
+        }
+
+        activeTop = lb.top;
+        activeBottom = height - lb.bottom;
+        activeLeft = lb.left;
+        activeRight = width - lb.right;
+    }
+
     // Convert RGBA float to UYVY (4:2:2 format) with vertical flip
-    for (int y = 0; y < height; ++y) {
+    for (int y = activeTop; y < activeBottom; ++y) {
         int srcRow = height - 1 - y; // Flip vertically: OpenFX uses bottom-left origin, NDI expects top-left
-        for (int x = 0; x < width; x += 2) {
+        ScopeBand* scopeBand = data->scopesActive ? &data->scopeBands[y * kScopeBands / height] : nullptr;
+        for (int x = activeLeft; x < activeRight; x += 2) {
             int srcIdx1 = (srcRow * width + x) * 4;
             int srcIdx2 = (srcRow * width + x + 1) * 4;
             int dstIdx = (y * width + x) * 2;
@@ -488,8 +976,18 @@ static void convertRGBAToUYVY_CPU(NDIInstanceData* data, void* rgbaData, int wid
             dstData[dstIdx + 1] = static_cast<uint8_t>(y1 * 255.0f);          // Y1
             dstData[dstIdx + 2] = static_cast<uint8_t>((v + 0.5f) * 255.0f);  // V
             dstData[dstIdx + 3] = static_cast<uint8_t>(y2 * 255.0f);          // Y2
+
+            if (scopeBand) {
+                accumulateScopeSample(*scopeBand, x * kScopeColumns / width, y1, r1, g1, b1);
+                if (x + 1 < width) {
+                    accumulateScopeSample(*scopeBand, (x + 1) * kScopeColumns / width, y2, r2, g2, b2);
+                }
+            }
         }
     }
+    if (data->scopesActive) {
+        data->scopesAccumulated = true;
+    }
     
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
@@ -529,6 +1027,181 @@ static void asyncFrameProcessor(NDIInstanceData* data)
     NDI_LOG("Async frame processor thread stopped\n");
 }
 
+// Memory pressure sampling
+static const char* memoryPressureName(int level)
+{
+    return level == kMemoryPressureCritical ? "critical" :
+           level == kMemoryPressureModerate ? "moderate" : "none";
+}
+
+#ifdef __linux__
+static bool readMemoryPSI(double& someAvg10, double& fullAvg10)
+{
+    FILE* file = fopen("/proc/pressure/memory", "r");
+    if (!file) {
+        return false;
+    }
+    // some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+    // full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+    int parsed = fscanf(file, "some avg10=%lf %*[^\n] full avg10=%lf", &someAvg10, &fullAvg10);
+    fclose(file);
+    return parsed == 2;
+}
+
+static bool readMemoryValue(const std::string& path, double& value)
+{
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) {
+        return false;
+    }
+    // cgroup v2 reports "max" when there is no limit
+    char buffer[64] = {0};
+    bool ok = fgets(buffer, sizeof(buffer), file) != nullptr && strncmp(buffer, "max", 3) != 0;
+    fclose(file);
+    if (ok) {
+        value = strtod(buffer, nullptr);
+    }
+    return ok;
+}
+
+// Reads one "<key> <value>" line from a cgroup memory.stat file
+static bool readMemoryStat(const std::string& path, const char* key, double& value)
+{
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) {
+        return false;
+    }
+    bool found = false;
+    char name[64];
+    double statValue;
+    while (!found && fscanf(file, "%63s %lf", name, &statValue) == 2) {
+        if (strcmp(name, key) == 0) {
+            value = statValue;
+            found = true;
+        }
+    }
+    fclose(file);
+    return found;
+}
+
+static bool readCgroupMemoryRatio(double& ratio)
+{
+    // Find this process's cgroup: "0::<path>" for v2, "<id>:memory:<path>" for v1
+    std::string v2Path, v1Path;
+    if (FILE* file = fopen("/proc/self/cgroup", "r")) {
+        char line[512];
+        while (fgets(line, sizeof(line), file)) {
+            std::string entry(line);
+            entry.erase(entry.find_last_not_of("\n") + 1);
+            if (entry.compare(0, 3, "0::") == 0) {
+                v2Path = entry.substr(3);
+            } else if (entry.find(":memory:") != std::string::npos) {
+                v1Path = entry.substr(entry.find(":memory:") + 8);
+            }
+        }
+        fclose(file);
+    }
+    if (v2Path == "/") v2Path.clear();
+    if (v1Path == "/") v1Path.clear();
+
+    // Usage includes page cache, which sits near the limit whenever media has been read, so
+    // reclaimable inactive file pages are subtracted
+    double limit = 0.0, usage = 0.0, inactiveFile = 0.0;
+    std::string v2Base = "/sys/fs/cgroup" + v2Path;
+    bool found = readMemoryValue(v2Base + "/memory.max", limit) &&
+                 readMemoryValue(v2Base + "/memory.current", usage);
+    if (found) {
+        readMemoryStat(v2Base + "/memory.stat", "inactive_file", inactiveFile);
+    }
+
+    // cgroup v1 fallback, trying the namespaced root too; an unlimited group reports a huge limit
+    const std::string v1Bases[2] = { "/sys/fs/cgroup/memory" + v1Path, "/sys/fs/cgroup/memory" };
+    for (int i = 0; i < 2 && !found; ++i) {
+        found = readMemoryValue(v1Bases[i] + "/memory.limit_in_bytes", limit) &&
+                readMemoryValue(v1Bases[i] + "/memory.usage_in_bytes", usage) &&
+                limit < 1.0e18;
+        if (found) {
+            readMemoryStat(v1Bases[i] + "/memory.stat", "total_inactive_file", inactiveFile);
+        }
+    }
+
+    if (!found || limit <= 0.0) {
+        return false;
+    }
+    ratio = std::max(0.0, usage - inactiveFile) / limit;
+    return true;
+}
+#endif
+
+// Samples the current memory pressure; always none on platforms without PSI or cgroups
+static int sampleMemoryPressure()
+{
+#ifdef __linux__
+    int level = kMemoryPressureNone;
+
+    double someAvg10 = 0.0, fullAvg10 = 0.0;
+    if (readMemoryPSI(someAvg10, fullAvg10)) {
+        if (fullAvg10 >= kMemoryPSIFullThreshold) {
+            level = kMemoryPressureCritical;
+        } else if (someAvg10 >= kMemoryPSISomeThreshold) {
+            level = kMemoryPressureModerate;
+        }
+    }
+
+    double ratio = 0.0;
+    if (readCgroupMemoryRatio(ratio)) {
+        if (ratio >= kMemoryCgroupCriticalRatio) {
+            level = std::max<int>(level, kMemoryPressureCritical);
+        } else if (ratio >= kMemoryCgroupModerateRatio) {
+            level = std::max<int>(level, kMemoryPressureModerate);
+        }
+    }
+
+    return level;
+#else
+    return kMemoryPressureNone;
+#endif
+}
+
+// Frees a buffer unless it backs the frame NDI may still be reading; returns the bytes freed
+template <typename T>
+static size_t releaseBuffer(std::vector<T>& buffer, const void* sentBuffer)
+{
+    if (buffer.empty() || buffer.data() == sentBuffer) {
+        return 0;
+    }
+    size_t bytes = buffer.capacity() * sizeof(T);
+    std::vector<T>().swap(buffer);
+    return bytes;
+}
+
+static size_t instanceBufferBytes(NDIInstanceData* data)
+{
+    return data->frameBuffer.capacity() +
+           data->hdrFrameBuffer.capacity() * sizeof(uint16_t) +
+           data->uyvyFrameBuffer.capacity() +
+           data->scopeBands.capacity() * sizeof(ScopeBand);
+}
+
+// Frees conversion buffers left over from formats that are no longer sent (after toggling HDR
+// or Optimal Format) and the scope bands once scopes are off. Every send path fills exactly one
+// buffer, so in steady state this finds nothing to free. Called on the render thread after a
+// frame is sent and its scopes finished: that send has released any earlier async frame, so
+// only sentBuffer can still be read by NDI.
+static void releaseStaleBuffers(NDIInstanceData* data, const void* sentBuffer)
+{
+    size_t freed = releaseBuffer(data->frameBuffer, sentBuffer) +
+                   releaseBuffer(data->hdrFrameBuffer, sentBuffer) +
+                   releaseBuffer(data->uyvyFrameBuffer, sentBuffer);
+    if (!data->scopesEnabled && !data->scopesActive) {
+        freed += releaseBuffer(data->scopeBands, nullptr);
+    }
+    if (freed > 0) {
+        NDI_LOG("Released %.1f MB of buffers no longer in use, frame buffers now %.1f MB",
+                freed / (1024.0 * 1024.0), instanceBufferBytes(data) / (1024.0 * 1024.0));
+    }
+}
+
 // Utility functions
 static OfxStatus fetchHostSuites(void)
 {
@@ -541,6 +1214,7 @@ static OfxStatus fetchHostSuites(void)
     gMemoryHost   = (OfxMemorySuiteV1 *)      gHost->fetchSuite(gHost->host, kOfxMemorySuite, 1);
     gThreadHost   = (OfxMultiThreadSuiteV1 *) gHost->fetchSuite(gHost->host, kOfxMultiThreadSuite, 1);
     gMessageSuite = (OfxMessageSuiteV1 *)     gHost->fetchSuite(gHost->host, kOfxMessageSuite, 1);
+    gProgressHost = (OfxProgressSuiteV1 *)    gHost->fetchSuite(gHost->host, kOfxProgressSuite, 1); // Optional
     
     if(!gEffectHost || !gPropHost || !gParamHost || !gMemoryHost || !gThreadHost)
         return kOfxStatErrMissingHostFeature;
@@ -702,14 +1376,36 @@ static void createHDRMetadata(NDIInstanceData* data)
     NDI_LOG("HDR Metadata: %s", data->hdrMetadataXML.c_str());
 }
 
-static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int height)
+static void convertRGBAToRGBA8(NDIInstanceData* data, void* imageData, int width, int height)
 {
-    if (!data->enabled || !data->ndiInitialized || !imageData) {
-        return;
+    data->lastBackend = "CPU";
+
+    const size_t frameSize = width * height * 4 * sizeof(uint8_t);
+    if (data->frameBuffer.size() != frameSize) {
+        data->frameBuffer.resize(frameSize);
     }
+
+    // Convert float RGBA to uint8_t RGBA for NDI with vertical flip
+    float* srcData = static_cast<float*>(imageData);
+    uint8_t* dstData = data->frameBuffer.data();
     
-    NDI_LOG("Sending HDR frame %dx%d to NDI", width, height);
+    // Flip vertically: OpenFX uses bottom-left origin, NDI expects top-left
+    for (int y = 0; y < height; ++y) {
+        int srcRow = height - 1 - y; // Flip vertically
+        for (int x = 0; x < width; ++x) {
+            int srcIdx = (srcRow * width + x) * 4;
+            int dstIdx = (y * width + x) * 4;
+            
+            dstData[dstIdx + 0] = static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, srcData[srcIdx + 0])) * 255.0f); // R
+            dstData[dstIdx + 1] = static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, srcData[srcIdx + 1])) * 255.0f); // G
+            dstData[dstIdx + 2] = static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, srcData[srcIdx + 2])) * 255.0f); // B
+            dstData[dstIdx + 3] = static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, srcData[srcIdx + 3])) * 255.0f); // A
+        }
+    }
+}
 
+static void convertRGBAToP216(NDIInstanceData* data, float* srcData, int width, int height)
+{
     // Prepare HDR frame buffer (16-bit per channel, P216 format)
     // P216 is planar YUV 4:2:2 with 16-bit samples
     const size_t frameSize = width * height * 2 * sizeof(uint16_t); // Y plane + UV plane (4:2:2)
@@ -718,7 +1414,6 @@ static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int
     }
 
     uint16_t* dstData = data->hdrFrameBuffer.data();
-    float* srcData = static_cast<float*>(imageData);
 
     // Try GPU acceleration first for HDR conversion
     bool gpuSuccess = false;
@@ -738,6 +1433,7 @@ static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int
         );
         
         if (gpuSuccess) {
+            data->lastBackend = "Metal";
             NDI_LOG("Metal GPU HDR conversion completed");
         } else {
             NDI_LOG("Metal GPU HDR conversion failed, falling back to CPU");
@@ -758,6 +1454,7 @@ static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int
         );
         
         if (gpuSuccess) {
+            data->lastBackend = "CUDA";
             NDI_LOG("CUDA GPU HDR conversion completed");
         } else {
             NDI_LOG("CUDA GPU HDR conversion failed, falling back to CPU");
@@ -767,15 +1464,47 @@ static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int
 
     // Fallback to CPU conversion if GPU failed or not available
     if (!gpuSuccess) {
+        data->lastBackend = "CPU";
+
         // Convert RGBA float to YUV 16-bit limited range (P216 format)
         // Reference: ITU BT.2100 quantization equations
         
         uint16_t* yPlane = dstData;
         uint16_t* uvPlane = dstData + (width * height);
         
-        for (int y = 0; y < height; ++y) {
+        // Fill constant letterbox bars directly and only convert the active picture
+        int activeTop = 0, activeBottom = height, activeLeft = 0, activeRight = width;
+        if (updateLetterbox(data, srcData, width, height)) {
+            const LetterboxState& lb = data->letterbox;
+            float r = std::max(0.0f, std::min(1.0f, lb.color[0]));
+            float g = std::max(0.0f, std::min(1.0f, lb.color[1]));
+            float b = std::max(0.0f, std::min(1.0f, lb.color[2]));
+            float luma = 0.2627f * r + 0.6780f * g + 0.0593f * b;
+            float u = -0.1396f * r - 0.3604f * g + 0.5f * b;
+            float v = 0.5f * r - 0.4598f * g - 0.0402f * b;
+            const uint16_t yPattern = static_cast<uint16_t>(4096 + luma * 56064);
+            const uint16_t uvPattern[2] = {
+                static_cast<uint16_t>(32768 + u * 28672),
+                static_cast<uint16_t>(32768 + v * 28672)
+            };
+            fillLetterboxBars(lb, reinterpret_cast<uint8_t*>(yPlane),
+                              reinterpret_cast<const uint8_t*>(&yPattern), sizeof(yPattern));
+            fillLetterboxBars(lb, reinterpret_cast<uint8_t*>(uvPlane),
+                              reinterpret_cast<const uint8_t*>(uvPattern), sizeof(uvPattern));
+            if (data->scopesActive) {
+                accumulateLetterboxScopes(data, luma, r, g, b);
+            }
+
+            activeTop = lb.top;
+            activeBottom = height - lb.bottom;
+            activeLeft = lb.left;
+            activeRight = width - lb.right;
+        }
+        
+        for (int y = activeTop; y < activeBottom; ++y) {
             int srcRow = height - 1 - y; // Flip vertically
-            for (int x = 0; x < width; x += 2) {
+            ScopeBand* scopeBand = data->scopesActive ? &data->scopeBands[y * kScopeBands / height] : nullptr;
+            for (int x = activeLeft; x < activeRight; x += 2) {
                 // Process two pixels for 4:2:2 subsampling
                 int srcIdx1 = (srcRow * width + x) * 4;
                 int srcIdx2 = (srcRow * width + x + 1) * 4;
@@ -822,9 +1551,34 @@ static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int
                 // Store U and V interleaved for 4:2:2
                 uvPlane[uvIdx * 2] = u_16;     // U
                 uvPlane[uvIdx * 2 + 1] = v_16; // V
+
+                if (scopeBand) {
+                    accumulateScopeSample(*scopeBand, x * kScopeColumns / width, y1, r1, g1, b1);
+                    if (x + 1 < width) {
+                        accumulateScopeSample(*scopeBand, (x + 1) * kScopeColumns / width, y2, r2, g2, b2);
+                    }
+                }
             }
         }
+        if (data->scopesActive) {
+            data->scopesAccumulated = true;
+        }
     }
+}
+
+static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int height)
+{
+    if (!data->enabled || !data->ndiInitialized || !imageData) {
+        return;
+    }
+    
+    NDI_LOG("Sending HDR frame %dx%d to NDI", width, height);
+
+    float* srcData = static_cast<float*>(imageData);
+
+    beginScopesFrame(data);
+    convertRGBAToP216(data, srcData, width, height);
+    uint16_t* dstData = data->hdrFrameBuffer.data();
 
     // Create HDR metadata
     createHDRMetadata(data);
@@ -845,6 +1599,9 @@ static void sendHDRFrame(NDIInstanceData* data, void* imageData, int width, int
 
     // Send the HDR frame
     NDIlib_send_send_video_v2(data->ndiSend, &ndiVideoFrame);
+
+    finishScopesFrame(data, srcData, width, height, 0.2627f, 0.6780f, 0.0593f);
+    releaseStaleBuffers(data, ndiVideoFrame.p_data);
 }
 
 static void sendSDRFrame(NDIInstanceData* data, void* imageData, int width, int height)
@@ -868,6 +1625,8 @@ static void sendSDRFrame(NDIInstanceData* data, void* imageData, int width, int
     ndiVideoFrame.timecode = NDIlib_send_timecode_synthesize;
     ndiVideoFrame.p_metadata = nullptr;
 
+    beginScopesFrame(data);
+
     if (data->optimalFormat) {
         // Use UYVY format for optimal NDI performance
         if (data->gpuAcceleration) {
@@ -881,31 +1640,10 @@ static void sendSDRFrame(NDIInstanceData* data, void* imageData, int width, int
         ndiVideoFrame.line_stride_in_bytes = width * 2; // UYVY is 2 bytes per pixel
     } else {
         // Use RGBA format (legacy compatibility)
-        const size_t frameSize = width * height * 4 * sizeof(uint8_t);
-        if (data->frameBuffer.size() != frameSize) {
-            data->frameBuffer.resize(frameSize);
-        }
-
-        // Convert float RGBA to uint8_t RGBA for NDI with vertical flip
-        float* srcData = static_cast<float*>(imageData);
-        uint8_t* dstData = data->frameBuffer.data();
-        
-        // Flip vertically: OpenFX uses bottom-left origin, NDI expects top-left
-        for (int y = 0; y < height; ++y) {
-            int srcRow = height - 1 - y; // Flip vertically
-            for (int x = 0; x < width; ++x) {
-                int srcIdx = (srcRow * width + x) * 4;
-                int dstIdx = (y * width + x) * 4;
-                
-                dstData[dstIdx + 0] = static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, srcData[srcIdx + 0])) * 255.0f); // R
-                dstData[dstIdx + 1] = static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, srcData[srcIdx + 1])) * 255.0f); // G
-                dstData[dstIdx + 2] = static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, srcData[srcIdx + 2])) * 255.0f); // B
-                dstData[dstIdx + 3] = static_cast<uint8_t>(std::max(0.0f, std::min(1.0f, srcData[srcIdx + 3])) * 255.0f); // A
-            }
-        }
+        convertRGBAToRGBA8(data, imageData, width, height);
 
         ndiVideoFrame.FourCC = NDIlib_FourCC_type_RGBA;
-        ndiVideoFrame.p_data = dstData;
+        ndiVideoFrame.p_data = data->frameBuffer.data();
         ndiVideoFrame.line_stride_in_bytes = width * 4;
     }
 
@@ -915,6 +1653,9 @@ static void sendSDRFrame(NDIInstanceData* data, void* imageData, int width, int
     } else {
         NDIlib_send_send_video_v2(data->ndiSend, &ndiVideoFrame);
     }
+
+    finishScopesFrame(data, static_cast<const float*>(imageData), width, height, 0.2126f, 0.7152f, 0.0722f);
+    releaseStaleBuffers(data, ndiVideoFrame.p_data);
 }
 
 static void sendNDIFrame(NDIInstanceData* data, void* imageData, int width, int height)
@@ -935,6 +1676,263 @@ static void sendNDIFrame(NDIInstanceData* data, void* imageData, int width, int
     }
 }
 
+// Benchmark
+struct BenchmarkResult {
+    std::string backend;
+    int frames;
+    double mpixPerSec;
+    std::vector<double> convertMs;
+    std::vector<double> sendMs;
+};
+
+static double benchmarkPercentile(std::vector<double> values, double p)
+{
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t idx = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+    return values[idx];
+}
+
+// Host progress bar for a benchmark run, which blocks the UI thread for several seconds
+struct BenchmarkProgress {
+    OfxImageEffectHandle effect;
+    bool shown;
+    bool cancelled;
+};
+
+static bool updateBenchmarkProgress(BenchmarkProgress& progress, double fraction)
+{
+    if (progress.shown && gProgressHost->progressUpdate(progress.effect, std::min(fraction, 1.0)) == kOfxStatReplyNo) {
+        progress.cancelled = true;
+    }
+    return !progress.cancelled;
+}
+
+static bool runBenchmarkBackend(NDIInstanceData* data, bool useGPU, float* frame, int width, int height,
+                                NDIlib_send_instance_t sender, BenchmarkProgress& progress, int backendIndex,
+                                BenchmarkResult& result)
+{
+    // Private instance so the benchmark doesn't disturb the live buffers or GPU context
+    NDIInstanceData bench{};
+    bench.enabled = true;
+    bench.frameRate = data->frameRate;
+    bench.gpuAcceleration = useGPU;
+    bench.optimalFormat = data->optimalFormat;
+    bench.hdrEnabled = data->hdrEnabled;
+    bench.letterboxSkip = data->letterboxSkip;
+    bench.lastBackend = "CPU";
+
+    if (useGPU && !initializeGPUContext(&bench)) {
+        return false;
+    }
+
+    auto runStart = std::chrono::high_resolution_clock::now();
+    double convertTotalMs = 0.0;
+    result.frames = 0;
+    while (result.frames < kBenchmarkMaxFrames) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+
+        NDIlib_video_frame_v2_t ndiVideoFrame;
+        ndiVideoFrame.xres = width;
+        ndiVideoFrame.yres = height;
+        ndiVideoFrame.frame_rate_N = static_cast<int>(bench.frameRate * 1000);
+        ndiVideoFrame.frame_rate_D = 1000;
+        ndiVideoFrame.picture_aspect_ratio = static_cast<float>(width) / static_cast<float>(height);
+        ndiVideoFrame.frame_format_type = NDIlib_frame_format_type_progressive;
+        ndiVideoFrame.timecode = NDIlib_send_timecode_synthesize;
+        ndiVideoFrame.p_metadata = nullptr;
+
+        if (bench.hdrEnabled) {
+            convertRGBAToP216(&bench, frame, width, height);
+            ndiVideoFrame.FourCC = NDIlib_FourCC_video_type_P216;
+            ndiVideoFrame.p_data = reinterpret_cast<uint8_t*>(bench.hdrFrameBuffer.data());
+            ndiVideoFrame.line_stride_in_bytes = width * sizeof(uint16_t);
+        } else if (bench.optimalFormat) {
+            if (useGPU) {
+                convertRGBAToUYVY_GPU(&bench, frame, width, height);
+            } else {
+                convertRGBAToUYVY_CPU(&bench, frame, width, height);
+            }
+            ndiVideoFrame.FourCC = NDIlib_FourCC_type_UYVY;
+            ndiVideoFrame.p_data = bench.uyvyFrameBuffer.data();
+            ndiVideoFrame.line_stride_in_bytes = width * 2;
+        } else {
+            convertRGBAToRGBA8(&bench, frame, width, height);
+            ndiVideoFrame.FourCC = NDIlib_FourCC_type_RGBA;
+            ndiVideoFrame.p_data = bench.frameBuffer.data();
+            ndiVideoFrame.line_stride_in_bytes = width * 4;
+        }
+
+        auto t1 = std::chrono::high_resolution_clock::now();
+        if (sender) {
+            NDIlib_send_send_video_v2(sender, &ndiVideoFrame);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        // A GPU run that silently fell back to the CPU isn't a separate backend
+        if (useGPU && strcmp(bench.lastBackend, "CPU") == 0) {
+            shutdownGPUContext(&bench);
+            return false;
+        }
+
+        double convertMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        result.convertMs.push_back(convertMs);
+        if (sender) {
+            result.sendMs.push_back(std::chrono::duration<double, std::milli>(t2 - t1).count());
+        }
+        convertTotalMs += convertMs;
+        result.frames++;
+
+        double elapsed = std::chrono::duration<double>(t2 - runStart).count();
+        if (!updateBenchmarkProgress(progress, (backendIndex + elapsed / kBenchmarkSecondsPerBackend) / 2.0) ||
+            elapsed >= kBenchmarkSecondsPerBackend) {
+            break;
+        }
+    }
+
+    shutdownGPUContext(&bench);
+
+    result.backend = bench.lastBackend;
+    result.mpixPerSec = convertTotalMs > 0.0
+        ? (static_cast<double>(width) * height * result.frames) / (convertTotalMs * 1000.0)
+        : 0.0;
+    return true;
+}
+
+static void runBenchmark(OfxImageEffectHandle effect, NDIInstanceData* data)
+{
+    int width = data->lastWidth > 0 ? data->lastWidth : kBenchmarkDefaultWidth;
+    int height = data->lastHeight > 0 ? data->lastHeight : kBenchmarkDefaultHeight;
+    const char* format = data->hdrEnabled ? "P216" : (data->optimalFormat ? "UYVY" : "RGBA");
+
+    // The benchmark allocates a synthetic frame and a full set of conversion buffers
+    int memoryPressure = sampleMemoryPressure();
+    if (memoryPressure == kMemoryPressureCritical) {
+        NDI_LOG("Benchmark skipped: memory pressure is critical");
+        gParamHost->paramSetValue(data->benchmarkReportParam,
+                                  "Benchmark skipped: system is under critical memory pressure\n");
+        return;
+    }
+
+    NDI_LOG("Running benchmark at %dx%d %s", width, height, format);
+
+    // Synthetic gradient with no constant regions
+    std::vector<float> frame(static_cast<size_t>(width) * height * 4);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            float* px = &frame[(static_cast<size_t>(y) * width + x) * 4];
+            px[0] = static_cast<float>(x) / width;
+            px[1] = static_cast<float>(y) / height;
+            px[2] = static_cast<float>((x + y) % 256) / 255.0f;
+            px[3] = 1.0f;
+        }
+    }
+
+    // Test frames go to a temporary unclocked sender so live receivers never see them.
+    // Without a running NDI library the send stage is stubbed out
+    NDIlib_send_instance_t sender = nullptr;
+    std::string benchmarkSourceName = data->sourceName + kBenchmarkSourceSuffix;
+    if (data->ndiInitialized) {
+        NDIlib_send_create_t createDesc;
+        createDesc.p_ndi_name = benchmarkSourceName.c_str();
+        createDesc.p_groups = nullptr;
+        createDesc.clock_video = false;
+        createDesc.clock_audio = false;
+        sender = NDIlib_send_create(&createDesc);
+        if (!sender) {
+            NDI_LOG("Failed to create benchmark NDI sender, send stage will not be measured");
+        }
+    }
+
+    BenchmarkProgress progress;
+    progress.effect = effect;
+    progress.shown = gProgressHost && gProgressHost->progressStart(effect, "Running NDI Output benchmark") == kOfxStatOK;
+    progress.cancelled = false;
+
+    std::vector<BenchmarkResult> results;
+    for (int gpu = 0; gpu < 2 && !progress.cancelled; ++gpu) {
+        BenchmarkResult result;
+        if (runBenchmarkBackend(data, gpu != 0, frame.data(), width, height, sender, progress, gpu, result) &&
+            !progress.cancelled) {
+            results.push_back(result);
+        }
+    }
+
+    if (progress.shown) {
+        gProgressHost->progressEnd(effect);
+    }
+    if (sender) {
+        NDIlib_send_destroy(sender);
+    }
+
+    if (progress.cancelled) {
+        NDI_LOG("Benchmark cancelled");
+        gParamHost->paramSetValue(data->benchmarkReportParam, "Benchmark cancelled\n");
+        return;
+    }
+
+    std::string report;
+    char line[256];
+    snprintf(line, sizeof(line), "NDI Output v%s benchmark: %dx%d %s, %.1f s per backend, send: %s\n",
+             kPluginVersionString, width, height, format, kBenchmarkSecondsPerBackend,
+             sender ? "temporary NDI sender" : "stub (NDI not running)");
+    report += line;
+    snprintf(line, sizeof(line), "Memory: pressure %s, frame buffers %.1f MB\n",
+             memoryPressureName(memoryPressure),
+             instanceBufferBytes(data) / (1024.0 * 1024.0));
+    report += line;
+
+    const BenchmarkResult* best = nullptr;
+    for (const BenchmarkResult& result : results) {
+        snprintf(line, sizeof(line),
+                 "%s: %.1f MPix/s (%d frames), convert p50/p95/p99 %.2f/%.2f/%.2f ms",
+                 result.backend.c_str(), result.mpixPerSec, result.frames,
+                 benchmarkPercentile(result.convertMs, 0.50),
+                 benchmarkPercentile(result.convertMs, 0.95),
+                 benchmarkPercentile(result.convertMs, 0.99));
+        report += line;
+        if (!result.sendMs.empty()) {
+            snprintf(line, sizeof(line), ", send p50/p95/p99 %.2f/%.2f/%.2f ms",
+                     benchmarkPercentile(result.sendMs, 0.50),
+                     benchmarkPercentile(result.sendMs, 0.95),
+                     benchmarkPercentile(result.sendMs, 0.99));
+            report += line;
+        }
+        report += "\n";
+
+        if (!best || result.mpixPerSec > best->mpixPerSec) {
+            best = &result;
+        }
+    }
+
+    if (best) {
+        double fps = best->mpixPerSec * 1.0e6 / (static_cast<double>(width) * height);
+        snprintf(line, sizeof(line), "Chosen backend: %s (conversion sustains %.1f fps, output is %.2f fps)\n",
+                 best->backend.c_str(), fps, data->frameRate);
+        report += line;
+    } else {
+        report += "No backend completed\n";
+    }
+
+    // Write the report next to other temp files so it can be attached to support requests
+    const char* tempDir = std::getenv("TMPDIR");
+    if (!tempDir) tempDir = std::getenv("TEMP");
+    if (!tempDir) tempDir = "/tmp";
+    std::string reportPath = std::string(tempDir) + "/" + kBenchmarkReportFile;
+    if (FILE* file = fopen(reportPath.c_str(), "w")) {
+        fputs(report.c_str(), file);
+        fclose(file);
+        report += "Report written to " + reportPath + "\n";
+    } else {
+        NDI_LOG("Failed to write benchmark report to %s", reportPath.c_str());
+    }
+
+    NDI_LOG("Benchmark finished:\n%s", report.c_str());
+    gParamHost->paramSetValue(data->benchmarkReportParam, report.c_str());
+}
+
 // Plugin functions
 static OfxStatus onLoad(void)
 {
@@ -965,11 +1963,16 @@ static OfxStatus createInstance(OfxImageEffectHandle effect)
     myData->sourceName = "DaVinci Resolve NDI Output";
     myData->enabled = true;
     myData->frameRate = 25.0;
+    myData->lastWidth = 0;
+    myData->lastHeight = 0;
+    myData->lastBackend = "CPU";
     
     // GPU acceleration settings (default enabled for better performance)
     myData->gpuAcceleration = true;
     myData->asyncSending = true;
     myData->optimalFormat = true;
+    myData->letterboxSkip = false;
+    myData->letterbox = LetterboxState();
     myData->stopAsyncThread = false;
     
     // HDR settings
@@ -979,6 +1982,13 @@ static OfxStatus createInstance(OfxImageEffectHandle effect)
     myData->maxCLL = 1000.0;
     myData->maxFALL = 400.0;
 
+    // Remote scopes settings
+    myData->scopesEnabled = false;
+    myData->scopesInterval = 5;
+    myData->scopesFrameCounter = 0;
+    myData->scopesActive = false;
+    myData->scopesAccumulated = false;
+
     // Cache clip handles
     gEffectHost->clipGetHandle(effect, kOfxImageEffectSimpleSourceClipName, &myData->sourceClip, 0);
     gEffectHost->clipGetHandle(effect, kOfxImageEffectOutputClipName, &myData->outputClip, 0);
@@ -990,12 +2000,17 @@ static OfxStatus createInstance(OfxImageEffectHandle effect)
     gParamHost->paramGetHandle(paramSet, kParamGPUAcceleration, &myData->gpuAccelerationParam, 0);
     gParamHost->paramGetHandle(paramSet, kParamAsyncSending, &myData->asyncSendingParam, 0);
     gParamHost->paramGetHandle(paramSet, kParamOptimalFormat, &myData->optimalFormatParam, 0);
+    gParamHost->paramGetHandle(paramSet, kParamLetterboxSkip, &myData->letterboxSkipParam, 0);
     gParamHost->paramGetHandle(paramSet, kParamVersionLabel, &myData->versionLabelParam, 0);
     gParamHost->paramGetHandle(paramSet, kParamHDREnabled, &myData->hdrEnabledParam, 0);
     gParamHost->paramGetHandle(paramSet, kParamColorSpace, &myData->colorSpaceParam, 0);
     gParamHost->paramGetHandle(paramSet, kParamTransferFunction, &myData->transferFunctionParam, 0);
     gParamHost->paramGetHandle(paramSet, kParamMaxCLL, &myData->maxCLLParam, 0);
     gParamHost->paramGetHandle(paramSet, kParamMaxFALL, &myData->maxFALLParam, 0);
+    gParamHost->paramGetHandle(paramSet, kParamScopesEnabled, &myData->scopesEnabledParam, 0);
+    gParamHost->paramGetHandle(paramSet, kParamScopesInterval, &myData->scopesIntervalParam, 0);
+    gParamHost->paramGetHandle(paramSet, kParamRunBenchmark, &myData->runBenchmarkParam, 0);
+    gParamHost->paramGetHandle(paramSet, kParamBenchmarkReport, &myData->benchmarkReportParam, 0);
 
     // Set instance data
     gPropHost->propSetPointer(effectProps, kOfxPropInstanceData, 0, (void *) myData);
@@ -1036,6 +2051,12 @@ static OfxStatus instanceChanged(OfxImageEffectHandle effect, OfxPropertySetHand
         
         NDI_LOG("Parameter changed: %s", paramName);
         
+        // The benchmark button doesn't change any settings
+        if (strcmp(paramName, kParamRunBenchmark) == 0) {
+            runBenchmark(effect, myData);
+            return kOfxStatOK;
+        }
+        
         // Update parameter values
         char* sourceName;
         gParamHost->paramGetValue(myData->sourceNameParam, &sourceName);
@@ -1062,6 +2083,10 @@ static OfxStatus instanceChanged(OfxImageEffectHandle effect, OfxPropertySetHand
         gParamHost->paramGetValue(myData->optimalFormatParam, &optimalFormat);
         myData->optimalFormat = (optimalFormat != 0);
         
+        int letterboxSkip;
+        gParamHost->paramGetValue(myData->letterboxSkipParam, &letterboxSkip);
+        myData->letterboxSkip = (letterboxSkip != 0);
+        
         int hdrEnabled;
         gParamHost->paramGetValue(myData->hdrEnabledParam, &hdrEnabled);
         myData->hdrEnabled = (hdrEnabled != 0);
@@ -1084,6 +2109,14 @@ static OfxStatus instanceChanged(OfxImageEffectHandle effect, OfxPropertySetHand
         gParamHost->paramGetValue(myData->maxFALLParam, &maxFALL);
         myData->maxFALL = maxFALL;
         
+        int scopesEnabled;
+        gParamHost->paramGetValue(myData->scopesEnabledParam, &scopesEnabled);
+        myData->scopesEnabled = (scopesEnabled != 0);
+        
+        int scopesInterval;
+        gParamHost->paramGetValue(myData->scopesIntervalParam, &scopesInterval);
+        myData->scopesInterval = scopesInterval;
+        
         NDI_LOG("Updated params - sourceName='%s', enabled=%d, frameRate=%.2f, hdr=%d, colorSpace='%s', transferFunc='%s'", 
                myData->sourceName.c_str(), myData->enabled, myData->frameRate, myData->hdrEnabled, 
                myData->colorSpace.c_str(), myData->transferFunction.c_str());
@@ -1128,6 +2161,18 @@ static OfxStatus render(OfxImageEffectHandle instance, OfxPropertySetHandle inAr
     gParamHost->paramGetValue(myData->enabledParam, &enabled);
     myData->enabled = (enabled != 0);
     
+    int letterboxSkip;
+    gParamHost->paramGetValue(myData->letterboxSkipParam, &letterboxSkip);
+    myData->letterboxSkip = (letterboxSkip != 0);
+    
+    int scopesEnabled;
+    gParamHost->paramGetValue(myData->scopesEnabledParam, &scopesEnabled);
+    myData->scopesEnabled = (scopesEnabled != 0);
+    
+    int scopesInterval;
+    gParamHost->paramGetValue(myData->scopesIntervalParam, &scopesInterval);
+    myData->scopesInterval = scopesInterval;
+    
     // Log current parameter state for debugging
     NDI_LOG("Render params - enabled=%d, hdr=%d, gpu=%d", 
            myData->enabled, myData->hdrEnabled, myData->gpuAcceleration);
@@ -1179,6 +2224,8 @@ static OfxStatus render(OfxImageEffectHandle instance, OfxPropertySetHandle inAr
         memcpy(dstData, srcData, height * dstRowBytes);
         
         // Send to NDI with vertical flip correction
+        myData->lastWidth = width;
+        myData->lastHeight = height;
         sendNDIFrame(myData, srcData, width, height);
     }
 
@@ -1259,6 +2306,11 @@ static OfxStatus describeInContext(OfxImageEffectHandle effect, OfxPropertySetHa
     gPropHost->propSetString(hdrGroupProps, kOfxPropLabel, 0, "HDR Settings");
     gPropHost->propSetInt(hdrGroupProps, kOfxParamPropGroupOpen, 0, 0); // Closed by default
 
+    OfxPropertySetHandle scopesGroupProps = NULL;
+    gParamHost->paramDefine(paramSet, kOfxParamTypeGroup, "scopesGroup", &scopesGroupProps);
+    gPropHost->propSetString(scopesGroupProps, kOfxPropLabel, 0, "Remote Scopes");
+    gPropHost->propSetInt(scopesGroupProps, kOfxParamPropGroupOpen, 0, 0); // Closed by default
+
     // Define version label parameter (visible read-only display) - in Info group
     OfxPropertySetHandle versionLabelProps = NULL;
     gParamHost->paramDefine(paramSet, kOfxParamTypeString, kParamVersionLabel, &versionLabelProps);
@@ -1333,6 +2385,36 @@ static OfxStatus describeInContext(OfxImageEffectHandle effect, OfxPropertySetHa
     gPropHost->propSetInt(optimalFormatProps, kOfxParamPropAnimates, 0, 0);
     gPropHost->propSetString(optimalFormatProps, kOfxParamPropParent, 0, "performanceGroup");
 
+    // Define letterbox skip parameter - in Performance group
+    OfxPropertySetHandle letterboxSkipProps = NULL;
+    gParamHost->paramDefine(paramSet, kOfxParamTypeBoolean, kParamLetterboxSkip, &letterboxSkipProps);
+    gPropHost->propSetString(letterboxSkipProps, kOfxPropLabel, 0, kParamLetterboxSkipLabel);
+    gPropHost->propSetString(letterboxSkipProps, kOfxParamPropScriptName, 0, kParamLetterboxSkip);
+    gPropHost->propSetString(letterboxSkipProps, kOfxParamPropHint, 0, kParamLetterboxSkipHint);
+    gPropHost->propSetInt(letterboxSkipProps, kOfxParamPropDefault, 0, 0); // Default to disabled
+    gPropHost->propSetInt(letterboxSkipProps, kOfxParamPropAnimates, 0, 0);
+    gPropHost->propSetString(letterboxSkipProps, kOfxParamPropParent, 0, "performanceGroup");
+
+    // Define run benchmark button - in Performance group
+    OfxPropertySetHandle runBenchmarkProps = NULL;
+    gParamHost->paramDefine(paramSet, kOfxParamTypePushButton, kParamRunBenchmark, &runBenchmarkProps);
+    gPropHost->propSetString(runBenchmarkProps, kOfxPropLabel, 0, kParamRunBenchmarkLabel);
+    gPropHost->propSetString(runBenchmarkProps, kOfxParamPropScriptName, 0, kParamRunBenchmark);
+    gPropHost->propSetString(runBenchmarkProps, kOfxParamPropHint, 0, kParamRunBenchmarkHint);
+    gPropHost->propSetString(runBenchmarkProps, kOfxParamPropParent, 0, "performanceGroup");
+
+    // Define benchmark report parameter (multi-line display) - in Performance group
+    OfxPropertySetHandle benchmarkReportProps = NULL;
+    gParamHost->paramDefine(paramSet, kOfxParamTypeString, kParamBenchmarkReport, &benchmarkReportProps);
+    gPropHost->propSetString(benchmarkReportProps, kOfxPropLabel, 0, kParamBenchmarkReportLabel);
+    gPropHost->propSetString(benchmarkReportProps, kOfxParamPropScriptName, 0, kParamBenchmarkReport);
+    gPropHost->propSetString(benchmarkReportProps, kOfxParamPropHint, 0, kParamBenchmarkReportHint);
+    gPropHost->propSetString(benchmarkReportProps, kOfxParamPropStringMode, 0, kOfxParamStringIsMultiLine);
+    gPropHost->propSetString(benchmarkReportProps, kOfxParamPropDefault, 0, "");
+    gPropHost->propSetInt(benchmarkReportProps, kOfxParamPropAnimates, 0, 0);
+    gPropHost->propSetInt(benchmarkReportProps, kOfxParamPropPersistant, 0, 0);
+    gPropHost->propSetString(benchmarkReportProps, kOfxParamPropParent, 0, "performanceGroup");
+
     // Define HDR enabled parameter - in HDR group
     OfxPropertySetHandle hdrEnabledProps = NULL;
     gParamHost->paramDefine(paramSet, kOfxParamTypeBoolean, kParamHDREnabled, &hdrEnabledProps);
@@ -1397,6 +2479,30 @@ static OfxStatus describeInContext(OfxImageEffectHandle effect, OfxPropertySetHa
     gPropHost->propSetInt(maxFALLProps, kOfxParamPropAnimates, 0, 0);
     gPropHost->propSetString(maxFALLProps, kOfxParamPropParent, 0, "hdrGroup");
 
+    // Define remote scopes enabled parameter - in Remote Scopes group
+    OfxPropertySetHandle scopesEnabledProps = NULL;
+    gParamHost->paramDefine(paramSet, kOfxParamTypeBoolean, kParamScopesEnabled, &scopesEnabledProps);
+    gPropHost->propSetString(scopesEnabledProps, kOfxPropLabel, 0, kParamScopesEnabledLabel);
+    gPropHost->propSetString(scopesEnabledProps, kOfxParamPropScriptName, 0, kParamScopesEnabled);
+    gPropHost->propSetString(scopesEnabledProps, kOfxParamPropHint, 0, kParamScopesEnabledHint);
+    gPropHost->propSetInt(scopesEnabledProps, kOfxParamPropDefault, 0, 0); // Default to disabled
+    gPropHost->propSetInt(scopesEnabledProps, kOfxParamPropAnimates, 0, 0);
+    gPropHost->propSetString(scopesEnabledProps, kOfxParamPropParent, 0, "scopesGroup");
+
+    // Define remote scopes interval parameter - in Remote Scopes group
+    OfxPropertySetHandle scopesIntervalProps = NULL;
+    gParamHost->paramDefine(paramSet, kOfxParamTypeInteger, kParamScopesInterval, &scopesIntervalProps);
+    gPropHost->propSetString(scopesIntervalProps, kOfxPropLabel, 0, kParamScopesIntervalLabel);
+    gPropHost->propSetString(scopesIntervalProps, kOfxParamPropScriptName, 0, kParamScopesInterval);
+    gPropHost->propSetString(scopesIntervalProps, kOfxParamPropHint, 0, kParamScopesIntervalHint);
+    gPropHost->propSetInt(scopesIntervalProps, kOfxParamPropDefault, 0, 5);
+    gPropHost->propSetInt(scopesIntervalProps, kOfxParamPropMin, 0, 1);
+    gPropHost->propSetInt(scopesIntervalProps, kOfxParamPropMax, 0, 120);
+    gPropHost->propSetInt(scopesIntervalProps, kOfxParamPropDisplayMin, 0, 1);
+    gPropHost->propSetInt(scopesIntervalProps, kOfxParamPropDisplayMax, 0, 30);
+    gPropHost->propSetInt(scopesIntervalProps, kOfxParamPropAnimates, 0, 0);
+    gPropHost->propSetString(scopesIntervalProps, kOfxParamPropParent, 0, "scopesGroup");
+
     return kOfxStatOK;
 }
 